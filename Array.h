@@ -23,10 +23,22 @@
         int length()
         int capacity()
         void sort()
+        void nthElement(int k)
+        void partialSort(int k)
+        Array<T> topK(int k, Compare compare)
+        T median()
         void fill(T value)
         void clear()
         void print()
         void reverse()
+        void inclusiveScan()
+        void exclusiveScan()
+        T sum()
+        T kahanSum()
+        T min()
+        T max()
+        std::pair<int, int> minMaxIndex()
+        T dot(const Array<T>& arr)
         void operator=(const Array<T>& arr)
         bool operator==(const Array<T>& arr)
         T& operator[](int position)
@@ -39,11 +51,28 @@
 #define ARRAY_ARRAY_H
 #include <initializer_list>
 #include <iostream>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+// Member functions are constexpr when the compiler allows new/delete in constant evaluation (C++20)
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L
+#define ARRAY_CONSTEXPR constexpr
+#else
+#define ARRAY_CONSTEXPR
+#endif
+
 namespace justin_su
 {
+    template<class T>
+    class ArrayLoader;
+
     template<class T>
     /**
      * Justin Su's implementation of a fixed Array data structure
+     * Under C++20 every member function except print is constexpr, so a table can be
+     * built with an Array inside a constexpr function and copied out to fixed storage.
      * @tparam T as datatype Array will have
      */
     class Array
@@ -56,7 +85,7 @@ namespace justin_su
              * Sets maxSize to be 10.
              * Sets array to be a dynamic array with 10 elements.
              */
-            Array();
+            ARRAY_CONSTEXPR Array();
 
             /**
              * Creates an array with a maximum size of given maxSize.
@@ -65,7 +94,7 @@ namespace justin_su
              * Sets array pointer to a dynamic array with given maxSize.
              * @param maxSize max number of elements array can hold as int
              */
-            Array(int maxSize);
+            ARRAY_CONSTEXPR Array(int maxSize);
 
 
             /**
@@ -76,7 +105,7 @@ namespace justin_su
              * Copies elements from existingArray.array to array.
              * @param arr as existing instance of this class.
              */
-            Array(const Array<T>& existingArray);
+            ARRAY_CONSTEXPR Array(const Array<T>& existingArray);
 
 
             /**
@@ -86,7 +115,7 @@ namespace justin_su
              * Copies elements from list to array pointer
              * @param list as initializer_list of elements with data type T to be copied
              */
-            Array(const std::initializer_list<T>& list);
+            ARRAY_CONSTEXPR Array(const std::initializer_list<T>& list);
 
             /**
              * Constructor with initializer list and maxSize
@@ -98,13 +127,13 @@ namespace justin_su
              * @param list
              * @param maxSize
              */
-            Array(const std::initializer_list<T>& list,int maxSize);
+            ARRAY_CONSTEXPR Array(const std::initializer_list<T>& list,int maxSize);
 
             /**
              * Destructor.
              * Deallocates array pointer.
              */
-            ~Array();
+            ARRAY_CONSTEXPR ~Array();
 
             /**
              * Inserts given newValue at beginning of array.
@@ -115,7 +144,7 @@ namespace justin_su
              *                Size is increased by 1.
              * @param newValue as new element to be added to start of array with data type T
              */
-            void insertAtStart(T newValue);
+            ARRAY_CONSTEXPR void insertAtStart(T newValue);
 
 
 
@@ -128,7 +157,7 @@ namespace justin_su
              *                Size is increased by 1
              * @param newValue as new element to be added to end of array with data type T
              */
-            void insertAtEnd(T newValue);
+            ARRAY_CONSTEXPR void insertAtEnd(T newValue);
 
             /**
              * Insert given new value at given position.
@@ -139,7 +168,7 @@ namespace justin_su
              * @param position as zero-based index to insert new element at
              * @param newValue as newValue to be inserted into array with data type of T
              */
-            void insertAt(int position, T newValue);
+            ARRAY_CONSTEXPR void insertAt(int position, T newValue);
 
 
             /**
@@ -149,7 +178,7 @@ namespace justin_su
              * Postcondition: The first element of array has been removed
              *                Size is decreased by 1
              */
-            void removeAtStart();
+            ARRAY_CONSTEXPR void removeAtStart();
 
             /**
              * Remove the last element in the array.
@@ -158,7 +187,7 @@ namespace justin_su
              * Postcondition: The last element of array has been removed
              *                Size is decreased by 1
              */
-            void removeAtEnd();
+            ARRAY_CONSTEXPR void removeAtEnd();
 
             /**
              * Remove the element at given position.
@@ -167,7 +196,7 @@ namespace justin_su
              * Otherwise remove the element at the given position.
              * @param position as the zero-based index
              */
-            void removeAt(int position);
+            ARRAY_CONSTEXPR void removeAt(int position);
 
             /**
              * Return the zero-based index of the first occurrence of the given value.
@@ -178,7 +207,7 @@ namespace justin_su
              * @param value as target value to search for
              * @return the index where the given value is at or -1
              */
-            int indexOf(T value);
+            ARRAY_CONSTEXPR int indexOf(T value);
 
 
 
@@ -189,7 +218,7 @@ namespace justin_su
              * Postcondition: The first element of the array is returned
              * @return the first elememt of the array
              */
-            T front();
+            ARRAY_CONSTEXPR T front();
 
 
             /**
@@ -199,7 +228,7 @@ namespace justin_su
              * Postcondition: The last element of the array is returned.
              * @return
              */
-            T back();
+            ARRAY_CONSTEXPR T back();
 
 
             /**
@@ -207,7 +236,7 @@ namespace justin_su
              * @param position as index of element to be returned
              * @return the element of the array at the given position
              */
-            T at(int position);
+            ARRAY_CONSTEXPR T at(int position);
 
 
             /**
@@ -215,7 +244,7 @@ namespace justin_su
              * Array is full when size == maxSize
              * @return true if array is full, false otherwise
              */
-            bool isFull();
+            ARRAY_CONSTEXPR bool isFull();
 
 
             /**
@@ -223,19 +252,19 @@ namespace justin_su
              * Array is empty when size == 0
              * @return true if array is empty, false otherwise
              */
-            bool isEmpty();
+            ARRAY_CONSTEXPR bool isEmpty();
 
             /**
              * Return the size of the array.
              * @return size of array as int
              */
-            int length();
+            ARRAY_CONSTEXPR int length();
 
             /**
              * Return the maxSize of the array.
              * @return maxSize of array as int
              */
-            int capacity();
+            ARRAY_CONSTEXPR int capacity();
 
             /**
              * Sort the array in ascending order.
@@ -244,7 +273,51 @@ namespace justin_su
              * Precondition: Array has some elements
              * Postcondition: Array is sorted in ascending order
              */
-            void sort();
+            ARRAY_CONSTEXPR void sort();
+
+            /**
+             * Reorder the array so the element at index k is the one that would be there if the
+             * array was sorted, every element before it is not greater and every element after
+             * it is not smaller.
+             * Uses introselect: quickselect with median of three pivots, switching to heap sort
+             * when partitioning goes too deep, so it is O(size) on average and O(size log size) at worst.
+             * If k is out of bounds, throw runtime_error
+             * @param k as zero-based index of the element to place
+             */
+            ARRAY_CONSTEXPR void nthElement(int k);
+
+            /**
+             * Reorder the array so the first k elements are the k smallest in ascending order.
+             * The order of the remaining elements is unspecified.
+             * Small k keeps a heap of the k smallest while scanning, otherwise the k smallest
+             * are selected with introselect. Either way they are then heap sorted.
+             * If k is less than 0 or greater than size, throw runtime_error
+             * @param k as number of smallest elements to sort
+             */
+            ARRAY_CONSTEXPR void partialSort(int k);
+
+            /**
+             * Return a new array holding the first k elements of this array ordered by compare.
+             * compare(a, b) returns true if a goes before b, so std::less gives the k smallest
+             * and std::greater gives the k largest. This array is not changed.
+             * When k is small compared to size, elements stream through a heap of k elements
+             * so only the heap has to stay in cache. Otherwise a copy is partially sorted.
+             * If k is not greater than 0 or greater than size, throw runtime_error
+             * @param k as number of elements to return
+             * @param compare as callable that returns true if its first argument goes first
+             * @return Array with maxSize k holding the k first elements in compare order
+             */
+            template<class Compare>
+            ARRAY_CONSTEXPR Array<T> topK(int k, Compare compare);
+
+            /**
+             * Return the median of the array.
+             * For an even size, returns the lower of the two middle elements.
+             * Selects the median from a copy, so this array is not changed.
+             * If array is empty, throw runtime_error
+             * @return the median element
+             */
+            ARRAY_CONSTEXPR T median();
 
             /**
              * Fill the array with given value.
@@ -252,7 +325,7 @@ namespace justin_su
              * Postcondition: Array is filled to maxSize with given value
              * @param value as value the entire array is filled with
              */
-            void fill(T value);
+            ARRAY_CONSTEXPR void fill(T value);
 
             /**
              * Clear the array.
@@ -262,7 +335,7 @@ namespace justin_su
              * Postcondition: Array is deallocated
              *                Size is set to 0
              */
-            void clear();
+            ARRAY_CONSTEXPR void clear();
 
             /**
              * Reverses the elements of the array.
@@ -270,7 +343,71 @@ namespace justin_su
              * Precondition: Array has some elements
              * Postcondition: The order of the elements in the array are reversed.
              */
-            void reverse();
+            ARRAY_CONSTEXPR void reverse();
+
+            /**
+             * Replace each element with the sum of itself and every element before it.
+             * Arrays with at least PARALLEL_SCAN_SIZE elements are scanned by multiple threads
+             * in two passes: each thread totals its chunk, then each thread scans its chunk
+             * starting from the total of the chunks before it.
+             * Precondition: Array is empty or has some elements
+             * Postcondition: Element at index i is the sum of elements 0 to i
+             */
+            void inclusiveScan();
+
+            /**
+             * Replace each element with the sum of every element before it.
+             * Uses the same multithreaded two pass scan as inclusiveScan for large arrays.
+             * Precondition: Array is empty or has some elements
+             * Postcondition: Element at index i is the sum of elements 0 to i - 1
+             *                The first element is the default value of T
+             */
+            void exclusiveScan();
+
+            /**
+             * Return the sum of the elements.
+             * Uses pairwise summation so rounding error of floating point T grows with log(size)
+             * If array is empty, return default value of T
+             * @return the sum of the elements
+             */
+            ARRAY_CONSTEXPR T sum();
+
+            /**
+             * Return the sum of the elements using Kahan compensated summation.
+             * Slower than sum but keeps rounding error of floating point T independent of size
+             * If array is empty, return default value of T
+             * @return the sum of the elements
+             */
+            ARRAY_CONSTEXPR T kahanSum();
+
+            /**
+             * Return the smallest element of the array.
+             * If array is empty, throw runtime_error
+             * @return the smallest element
+             */
+            ARRAY_CONSTEXPR T min();
+
+            /**
+             * Return the largest element of the array.
+             * If array is empty, throw runtime_error
+             * @return the largest element
+             */
+            ARRAY_CONSTEXPR T max();
+
+            /**
+             * Return the indexes of the first smallest and first largest element.
+             * If array is empty, throw runtime_error
+             * @return pair of index of smallest element and index of largest element
+             */
+            ARRAY_CONSTEXPR std::pair<int, int> minMaxIndex();
+
+            /**
+             * Return the dot product of this array and given arr.
+             * If sizes are different, throw runtime_error
+             * @param arr as existing instance of this class with the same size
+             * @return the sum of the products of elements at the same index
+             */
+            ARRAY_CONSTEXPR T dot(const Array<T>& arr);
 
             /**
              * Outputs the elements of the array in between brackets
@@ -286,7 +423,7 @@ namespace justin_su
              * Copies the elements
              * @param arr existing instance of this class
              */
-            void operator=(const Array<T>& arr);
+            ARRAY_CONSTEXPR void operator=(const Array<T>& arr);
 
             /**
              * Returns whether or not two instances of this class are equal.
@@ -294,7 +431,7 @@ namespace justin_su
              * @param arr as existing instance of this class
              * @return true if the instances of this class are equal, false if not
              */
-            bool operator==(const Array<T>& arr);
+            ARRAY_CONSTEXPR bool operator==(const Array<T>& arr);
 
 
             /**
@@ -303,12 +440,59 @@ namespace justin_su
              * @param index as index of element to be returned
              * @return the element at given index
              */
-            T& operator[](int index);
+            ARRAY_CONSTEXPR T& operator[](int index);
 
         private:
+            // ArrayLoader reads file chunks straight into array
+            friend class ArrayLoader<T>;
+
             T* array;
             int size;
             int maxSize;
+
+            /**
+             * Minimum size at which inclusiveScan and exclusiveScan use multiple threads.
+             */
+            static const int PARALLEL_SCAN_SIZE = 1 << 20;
+
+            /**
+             * Number of elements summed directly by pairwiseSum before splitting stops.
+             */
+            static const int PAIRWISE_BLOCK_SIZE = 128;
+
+            /**
+             * Scan count elements starting at values, adding initial to every result.
+             * @return the sum of initial and the count elements
+             */
+            static T scanRange(T* values, int count, T initial, bool inclusive);
+
+            /**
+             * Scan the whole array, using multiple threads for large arrays.
+             */
+            void scan(bool inclusive);
+
+            /**
+             * Sum count elements starting at values by recursively summing each half.
+             */
+            static ARRAY_CONSTEXPR T pairwiseSum(const T* values, int count);
+
+            /**
+             * Move element at given index down the heap of given heapSize until no child goes after it.
+             */
+            template<class Compare>
+            static ARRAY_CONSTEXPR void siftDown(T* values, int index, int heapSize, Compare compare);
+
+            /**
+             * Heap sort count elements starting at values in compare order.
+             */
+            template<class Compare>
+            static ARRAY_CONSTEXPR void heapSort(T* values, int count, Compare compare);
+
+            /**
+             * Introselect the element at index k of count elements starting at values in compare order.
+             */
+            template<class Compare>
+            static ARRAY_CONSTEXPR void select(T* values, int count, int k, Compare compare);
     };
 
 
@@ -319,7 +503,7 @@ namespace justin_su
      * @param T
      */
     template<class T>
-    Array<T>::Array(): size(0),maxSize(10)
+    ARRAY_CONSTEXPR Array<T>::Array(): size(0),maxSize(10)
     {
         // Sets array pointer to be a dynamic array with maxSize
         // Initialized to default value of T data type
@@ -329,7 +513,7 @@ namespace justin_su
 
 
     template<class T>
-    Array<T>::Array(int maxSize): size(0), maxSize(maxSize)
+    ARRAY_CONSTEXPR Array<T>::Array(int maxSize): size(0), maxSize(maxSize)
     {
         // If given maxSize is negative throw exception
         if (maxSize <= 0)
@@ -341,7 +525,7 @@ namespace justin_su
     }
 
     template<class T>
-    Array<T>::Array(const std::initializer_list<T> &list): size(list.size()), maxSize(list.size())
+    ARRAY_CONSTEXPR Array<T>::Array(const std::initializer_list<T> &list): size(list.size()), maxSize(list.size())
     {
 
         // Reallocates array pointer to have maxSize and default values
@@ -359,7 +543,7 @@ namespace justin_su
     }
 
     template<class T>
-    Array<T>::Array(const std::initializer_list<T> &list, int maxSize):size(list.size()), maxSize(maxSize)
+    ARRAY_CONSTEXPR Array<T>::Array(const std::initializer_list<T> &list, int maxSize):size(list.size()), maxSize(maxSize)
     {
         // Ensure given maxSize is greater than 1
         if (maxSize <= 0)
@@ -382,7 +566,7 @@ namespace justin_su
     }
 
     template<class T>
-    Array<T>::Array(const Array<T>& existingArray):size(existingArray.size), maxSize(existingArray.maxSize)
+    ARRAY_CONSTEXPR Array<T>::Array(const Array<T>& existingArray):size(existingArray.size), maxSize(existingArray.maxSize)
     {
         // Allocate memory for dynamic array
          array = new T[maxSize]{};
@@ -417,7 +601,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::reverse()
+    ARRAY_CONSTEXPR void Array<T>::reverse()
     {
         // If array only has one element or it is empty then return
         if (size == 1 || isEmpty())
@@ -442,34 +626,34 @@ namespace justin_su
 
 
     template<class T>
-    int Array<T>::length()
+    ARRAY_CONSTEXPR int Array<T>::length()
     {
         // Return the size member variable
         return size;
     }
 
     template<class T>
-    int Array<T>::capacity()
+    ARRAY_CONSTEXPR int Array<T>::capacity()
     {
         // Return the maxSize member variable
         return maxSize;
     }
 
     template<class T>
-    Array<T>::~Array()
+    ARRAY_CONSTEXPR Array<T>::~Array()
     {
         // Deallocate dynamic array
         delete[] array;
     }
 
     template<class T>
-    void Array<T>::insertAtStart(T newValue)
+    ARRAY_CONSTEXPR void Array<T>::insertAtStart(T newValue)
     {
         // If array is full, throw runtime_error
         if (isFull())
             throw std::runtime_error("insertAtStart: Array is full!");
         // Shift elements to right first
-        for (int i = size; i >= 0; i--)
+        for (int i = size - 1; i >= 0; i--)
         {
             array[i + 1] = array[i];
         }
@@ -480,7 +664,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::insertAtEnd(T newValue)
+    ARRAY_CONSTEXPR void Array<T>::insertAtEnd(T newValue)
     {
         // If array is full, throw runtime_error
         if (isFull())
@@ -492,7 +676,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::insertAt(int position,T newValue)
+    ARRAY_CONSTEXPR void Array<T>::insertAt(int position,T newValue)
     {
         // If given position is out of bounds, throw runtime error
         if (position < 0 || position > size - 1)
@@ -513,7 +697,7 @@ namespace justin_su
             return;
         }
         // Shift element at given position to right
-        for (int i = size; i >= position; i--)
+        for (int i = size - 1; i >= position; i--)
         {
             array[i + 1] = array[i];
         }
@@ -526,13 +710,13 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::removeAtStart()
+    ARRAY_CONSTEXPR void Array<T>::removeAtStart()
     {
         // If array is full, throw runtime error
         if (isEmpty())
             throw std::runtime_error("removeAtStart: Array is already empty!");
         // Shift elements to the left
-        for (int i = 0; i < size; i++)
+        for (int i = 0; i < size - 1; i++)
         {
             array[i] = array[i + 1];
         }
@@ -541,7 +725,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::removeAtEnd()
+    ARRAY_CONSTEXPR void Array<T>::removeAtEnd()
     {
         // If array is full, throw runtime error
         if (isEmpty())
@@ -557,7 +741,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::removeAt(int position)
+    ARRAY_CONSTEXPR void Array<T>::removeAt(int position)
     {
         // If given position is out of bounds, throw runtime_error
         if (position < 0 || position > size)
@@ -577,7 +761,7 @@ namespace justin_su
             removeAtEnd();
             return;
         }
-        for (int i = position; i < size; i++)
+        for (int i = position; i < size - 1; i++)
         {
             array[i] = array[i + 1];
         }
@@ -586,7 +770,7 @@ namespace justin_su
     }
 
     template<class T>
-    int Array<T>::indexOf(T value)
+    ARRAY_CONSTEXPR int Array<T>::indexOf(T value)
     {
         // Traverse array
         for (int i = 0; i < size; i++)
@@ -601,7 +785,7 @@ namespace justin_su
     }
 
     template<class T>
-    T Array<T>::front()
+    ARRAY_CONSTEXPR T Array<T>::front()
     {
         // If array is empty, throw runtime_error
         if (isEmpty())
@@ -611,7 +795,7 @@ namespace justin_su
     }
 
     template<class T>
-    T Array<T>::back()
+    ARRAY_CONSTEXPR T Array<T>::back()
     {
         // If array is empty, throw runtime_error
         if (isEmpty())
@@ -621,32 +805,32 @@ namespace justin_su
     }
 
     template<class T>
-    T Array<T>::at(int position)
+    ARRAY_CONSTEXPR T Array<T>::at(int position)
     {
         if (isEmpty())
             throw std::runtime_error("at: Array is empty!");
         if (position < 0 || position > size - 1)
             throw std::runtime_error("at: Given position is out of bounds!");
         // Return the element at given position
-        return array[position - 1];
+        return array[position];
     }
 
     template<class T>
-    bool Array<T>::isFull()
+    ARRAY_CONSTEXPR bool Array<T>::isFull()
     {
         // Return if size == maxSize
         return size == maxSize;
     }
 
     template<class T>
-    bool Array<T>::isEmpty()
+    ARRAY_CONSTEXPR bool Array<T>::isEmpty()
     {
         // Return if size is 0
         return size == 0;
     }
 
     template<class T>
-    void Array<T>::sort()
+    ARRAY_CONSTEXPR void Array<T>::sort()
     {
 		// If there are 0 or 1 element
 		 if (size == 1 || isEmpty())
@@ -677,7 +861,413 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::fill(T value)
+    template<class Compare>
+    ARRAY_CONSTEXPR void Array<T>::siftDown(T* values, int index, int heapSize, Compare compare)
+    {
+        while (true)
+        {
+            int last = index;
+            int left = 2 * index + 1;
+            int right = left + 1;
+            // Find which of the element and its children goes last
+            if (left < heapSize && compare(values[last], values[left]))
+                last = left;
+            if (right < heapSize && compare(values[last], values[right]))
+                last = right;
+            // Stop once no child goes after the element
+            if (last == index)
+                return;
+            // Swap
+            T temp = values[index];
+            values[index] = values[last];
+            values[last] = temp;
+            index = last;
+        }
+    }
+
+    template<class T>
+    template<class Compare>
+    ARRAY_CONSTEXPR void Array<T>::heapSort(T* values, int count, Compare compare)
+    {
+        // Build heap with the element that goes last at the root
+        for (int i = count / 2 - 1; i >= 0; i--)
+            siftDown(values, i, count, compare);
+        // Move root to the end of the unsorted part
+        for (int end = count - 1; end > 0; end--)
+        {
+            T temp = values[0];
+            values[0] = values[end];
+            values[end] = temp;
+            siftDown(values, 0, end, compare);
+        }
+    }
+
+    template<class T>
+    template<class Compare>
+    ARRAY_CONSTEXPR void Array<T>::select(T* values, int count, int k, Compare compare)
+    {
+        int left = 0;
+        int right = count - 1;
+        // Allow about twice the partitions a balanced quickselect needs
+        int depthLimit = 0;
+        for (int n = count; n > 1; n /= 2)
+            depthLimit += 2;
+        while (left < right)
+        {
+            // Partitioning went too deep, finish the range with heap sort
+            if (depthLimit == 0)
+            {
+                heapSort(values + left, right - left + 1, compare);
+                return;
+            }
+            depthLimit--;
+            // Order left, middle and right so the middle one is their median
+            int middle = left + (right - left) / 2;
+            if (compare(values[middle], values[left]))
+            {
+                T temp = values[middle];
+                values[middle] = values[left];
+                values[left] = temp;
+            }
+            if (compare(values[right], values[left]))
+            {
+                T temp = values[right];
+                values[right] = values[left];
+                values[left] = temp;
+            }
+            if (compare(values[right], values[middle]))
+            {
+                T temp = values[right];
+                values[right] = values[middle];
+                values[middle] = temp;
+            }
+            T pivot = values[middle];
+            // Partition so elements going before pivot are on the left and after pivot are on the right
+            int i = left;
+            int j = right;
+            while (i <= j)
+            {
+                while (compare(values[i], pivot))
+                    i++;
+                while (compare(pivot, values[j]))
+                    j--;
+                if (i <= j)
+                {
+                    T temp = values[i];
+                    values[i] = values[j];
+                    values[j] = temp;
+                    i++;
+                    j--;
+                }
+            }
+            // Continue in the part holding k, elements between j and i are equal to pivot
+            if (k <= j)
+                right = j;
+            else if (k >= i)
+                left = i;
+            else
+                return;
+        }
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR void Array<T>::nthElement(int k)
+    {
+        // If given k is out of bounds, throw runtime_error
+        if (k < 0 || k > size - 1)
+            throw std::runtime_error("nthElement: Given k is out of bounds!");
+        select(array, size, k, std::less<T>());
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR void Array<T>::partialSort(int k)
+    {
+        // If given k is out of bounds, throw runtime_error
+        if (k < 0 || k > size)
+            throw std::runtime_error("partialSort: Given k is out of bounds!");
+        // Small k: keep k smallest in a heap at the front, swapping in every smaller element
+        if (k > 0 && k <= size / 16)
+        {
+            for (int i = k / 2 - 1; i >= 0; i--)
+                siftDown(array, i, k, std::less<T>());
+            for (int i = k; i < size; i++)
+            {
+                if (array[i] < array[0])
+                {
+                    T temp = array[0];
+                    array[0] = array[i];
+                    array[i] = temp;
+                    siftDown(array, 0, k, std::less<T>());
+                }
+            }
+        }
+        // Otherwise move k smallest elements to the front with introselect
+        else if (k < size)
+            select(array, size, k, std::less<T>());
+        // Sort them
+        heapSort(array, k, std::less<T>());
+    }
+
+    template<class T>
+    template<class Compare>
+    ARRAY_CONSTEXPR Array<T> Array<T>::topK(int k, Compare compare)
+    {
+        // If given k is out of bounds, throw runtime_error
+        if (k <= 0 || k > size)
+            throw std::runtime_error("topK: Given k is out of bounds!");
+        Array<T> result(k);
+        // Small k: stream elements through a heap whose root is the element that goes last
+        if (k <= size / 16)
+        {
+            for (int i = 0; i < k; i++)
+                result.array[i] = array[i];
+            for (int i = k / 2 - 1; i >= 0; i--)
+                siftDown(result.array, i, k, compare);
+            // Replace root with every element that goes before it
+            for (int i = k; i < size; i++)
+            {
+                if (compare(array[i], result.array[0]))
+                {
+                    result.array[0] = array[i];
+                    siftDown(result.array, 0, k, compare);
+                }
+            }
+            heapSort(result.array, k, compare);
+            result.size = k;
+            return result;
+        }
+        // Large k: partially sort a copy
+        T* copy = new T[size]{};
+        for (int i = 0; i < size; i++)
+            copy[i] = array[i];
+        if (k < size)
+            select(copy, size, k, compare);
+        heapSort(copy, k, compare);
+        for (int i = 0; i < k; i++)
+            result.array[i] = copy[i];
+        result.size = k;
+        // Deallocate copy
+        delete[] copy;
+        return result;
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::median()
+    {
+        // If array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("median: Array is empty!");
+        // Select from a copy so this array keeps its order
+        T* copy = new T[size]{};
+        for (int i = 0; i < size; i++)
+            copy[i] = array[i];
+        int middle = (size - 1) / 2;
+        select(copy, size, middle, std::less<T>());
+        T result = copy[middle];
+        // Deallocate copy
+        delete[] copy;
+        return result;
+    }
+
+    template<class T>
+    T Array<T>::scanRange(T* values, int count, T initial, bool inclusive)
+    {
+        // Running total starts from the total of everything before this range
+        T running = initial;
+        for (int i = 0; i < count; i++)
+        {
+            T value = values[i];
+            // Inclusive scan counts current element, exclusive scan does not
+            if (inclusive)
+            {
+                running += value;
+                values[i] = running;
+            }
+            else
+            {
+                values[i] = running;
+                running += value;
+            }
+        }
+        return running;
+    }
+
+    template<class T>
+    void Array<T>::scan(bool inclusive)
+    {
+        int threadCount = std::thread::hardware_concurrency();
+        // Small arrays are not worth starting threads for
+        if (size < PARALLEL_SCAN_SIZE || threadCount < 2)
+        {
+            scanRange(array, size, T{}, inclusive);
+            return;
+        }
+        // Keep every chunk at least half of PARALLEL_SCAN_SIZE
+        if (threadCount > size / (PARALLEL_SCAN_SIZE / 2))
+            threadCount = size / (PARALLEL_SCAN_SIZE / 2);
+        int chunkSize = (size + threadCount - 1) / threadCount;
+        T* chunkTotals = new T[threadCount]{};
+        std::thread* threads = new std::thread[threadCount];
+        // First pass: total each chunk
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads[t] = std::thread([this, t, chunkSize, chunkTotals]()
+            {
+                int start = t * chunkSize;
+                int end = start + chunkSize < size ? start + chunkSize : size;
+                chunkTotals[t] = pairwiseSum(array + start, end - start);
+            });
+        }
+        for (int t = 0; t < threadCount; t++)
+            threads[t].join();
+        // Turn chunk totals into the total of every chunk before each chunk
+        scanRange(chunkTotals, threadCount, T{}, false);
+        // Second pass: scan each chunk starting from its offset
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads[t] = std::thread([this, t, chunkSize, chunkTotals, inclusive]()
+            {
+                int start = t * chunkSize;
+                int end = start + chunkSize < size ? start + chunkSize : size;
+                scanRange(array + start, end - start, chunkTotals[t], inclusive);
+            });
+        }
+        for (int t = 0; t < threadCount; t++)
+            threads[t].join();
+        // Deallocate threads and chunk totals
+        delete[] threads;
+        delete[] chunkTotals;
+    }
+
+    template<class T>
+    void Array<T>::inclusiveScan()
+    {
+        scan(true);
+    }
+
+    template<class T>
+    void Array<T>::exclusiveScan()
+    {
+        scan(false);
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::pairwiseSum(const T* values, int count)
+    {
+        // Split in half until the range is small
+        if (count > PAIRWISE_BLOCK_SIZE)
+        {
+            int half = count / 2;
+            return pairwiseSum(values, half) + pairwiseSum(values + half, count - half);
+        }
+        // Four independent running totals so additions do not wait on each other
+        T total0 = T{}, total1 = T{}, total2 = T{}, total3 = T{};
+        int i = 0;
+        for (; i + 3 < count; i += 4)
+        {
+            total0 += values[i];
+            total1 += values[i + 1];
+            total2 += values[i + 2];
+            total3 += values[i + 3];
+        }
+        // Add remaining elements
+        for (; i < count; i++)
+            total0 += values[i];
+        return (total0 + total1) + (total2 + total3);
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::sum()
+    {
+        return pairwiseSum(array, size);
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::kahanSum()
+    {
+        T total = T{};
+        // Rounding error lost from total so far
+        T compensation = T{};
+        for (int i = 0; i < size; i++)
+        {
+            T adjusted = array[i] - compensation;
+            T next = total + adjusted;
+            // Recover the low bits of adjusted that did not make it into next
+            compensation = (next - total) - adjusted;
+            total = next;
+        }
+        return total;
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::min()
+    {
+        // If array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("min: Array is empty!");
+        T smallest = array[0];
+        // Branch free select so the loop can be vectorized
+        for (int i = 1; i < size; i++)
+            smallest = array[i] < smallest ? array[i] : smallest;
+        return smallest;
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::max()
+    {
+        // If array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("max: Array is empty!");
+        T largest = array[0];
+        // Branch free select so the loop can be vectorized
+        for (int i = 1; i < size; i++)
+            largest = array[i] > largest ? array[i] : largest;
+        return largest;
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR std::pair<int, int> Array<T>::minMaxIndex()
+    {
+        // If array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("minMaxIndex: Array is empty!");
+        int minIndex = 0;
+        int maxIndex = 0;
+        // Strict comparisons keep the first occurrence
+        for (int i = 1; i < size; i++)
+        {
+            if (array[i] < array[minIndex])
+                minIndex = i;
+            if (array[i] > array[maxIndex])
+                maxIndex = i;
+        }
+        return std::pair<int, int>(minIndex, maxIndex);
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR T Array<T>::dot(const Array<T>& arr)
+    {
+        // If sizes are different, throw runtime_error
+        if (size != arr.size)
+            throw std::runtime_error("dot: Arrays have different sizes!");
+        // Four independent running totals so additions do not wait on each other
+        T total0 = T{}, total1 = T{}, total2 = T{}, total3 = T{};
+        int i = 0;
+        for (; i + 3 < size; i += 4)
+        {
+            total0 += array[i] * arr.array[i];
+            total1 += array[i + 1] * arr.array[i + 1];
+            total2 += array[i + 2] * arr.array[i + 2];
+            total3 += array[i + 3] * arr.array[i + 3];
+        }
+        // Add remaining products
+        for (; i < size; i++)
+            total0 += array[i] * arr.array[i];
+        return (total0 + total1) + (total2 + total3);
+    }
+
+    template<class T>
+    ARRAY_CONSTEXPR void Array<T>::fill(T value)
     {
         // Deallocate array pointer
         delete[] array;
@@ -694,7 +1284,7 @@ namespace justin_su
     }
 
     template<class T>
-    void Array<T>::clear()
+    ARRAY_CONSTEXPR void Array<T>::clear()
     {
         // Deallocate array pointer
         delete[] array;
@@ -706,7 +1296,7 @@ namespace justin_su
     }
 
     template <class T>
-    void Array<T>::operator=(const Array<T>& arr)
+    ARRAY_CONSTEXPR void Array<T>::operator=(const Array<T>& arr)
     {
         // Set size to the size of arr.size
         size = arr.size;
@@ -724,7 +1314,7 @@ namespace justin_su
     }
 
     template<class T>
-    bool Array<T>::operator==(const Array<T> &arr)
+    ARRAY_CONSTEXPR bool Array<T>::operator==(const Array<T> &arr)
     {
         // If size is not equal to arr.size or if maxSize is not equal to arr.maxSize
         if (size != arr.size || maxSize != arr.maxSize)
@@ -741,7 +1331,7 @@ namespace justin_su
 
 
     template<class T>
-    T& Array<T>::operator[](int index)
+    ARRAY_CONSTEXPR T& Array<T>::operator[](int index)
     {
         // If array is empty
         if (isEmpty())
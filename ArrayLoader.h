@@ -0,0 +1,265 @@
+//
+// Created by Justin Su on 10/19/2026.
+//
+/**
+    Constructors
+        ArrayLoader(const char* path)
+        ArrayLoader(const char* path, int chunkSize)
+    Destructors
+        ~ArrayLoader()
+    Member functions
+        long long length()
+        void loadInto(Array<T>& arr)
+        void loadInto(Array<T>& arr, Function onChunk)
+    Private member variables
+        int file;
+        long long fileSize;
+        int chunkSize;
+ */
+#ifndef ARRAY_ARRAYLOADER_H
+#define ARRAY_ARRAYLOADER_H
+#include <cerrno>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Array.h"
+namespace justin_su
+{
+    template<class T>
+    /**
+     * Justin Su's implementation of a streaming loader that fills an Array from a binary file.
+     * The file holds elements of T back to back in native byte order.
+     * A reader thread reads the file in chunks with pread directly into the storage of the
+     * Array, so while the caller processes chunk N the reader is already filling chunk N + 1.
+     * POSIX only.
+     * @tparam T as datatype of the elements in the file
+     */
+    class ArrayLoader
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "ArrayLoader: T needs to be trivially copyable");
+
+        public:
+
+            /**
+             * Opens the file at given path with chunks of 65536 elements.
+             * If file can not be opened, throw runtime_error
+             * If file size is not a multiple of sizeof(T), throw runtime_error
+             * @param path as path of the binary file
+             */
+            ArrayLoader(const char* path);
+
+            /**
+             * Opens the file at given path with chunks of given chunkSize elements.
+             * If chunkSize is not greater than 0, throw runtime_error
+             * If file can not be opened, throw runtime_error
+             * If file size is not a multiple of sizeof(T), throw runtime_error
+             * @param path as path of the binary file
+             * @param chunkSize as number of elements read at a time
+             */
+            ArrayLoader(const char* path, int chunkSize);
+
+            /**
+             * Destructor.
+             * Closes the file.
+             */
+            ~ArrayLoader();
+
+            /**
+             * Return the number of elements in the file.
+             * @return number of elements as long long
+             */
+            long long length();
+
+            /**
+             * Append every element of the file to the end of given arr.
+             * If arr does not have room for every element, throw runtime_error
+             * If reading fails, throw runtime_error. Chunks read before the failure stay in arr.
+             * @param arr as Array the elements are appended to
+             */
+            void loadInto(Array<T>& arr);
+
+            /**
+             * Append every element of the file to the end of given arr, calling onChunk on each chunk.
+             * onChunk is called as onChunk(T* elements, int count, int firstIndex) on the calling
+             * thread, in file order, once the chunk is in arr and arr.length() includes it.
+             * The next chunk is read while onChunk runs.
+             * If arr does not have room for every element, throw runtime_error
+             * If reading fails, throw runtime_error. Chunks read before the failure stay in arr.
+             * @param arr as Array the elements are appended to
+             * @param onChunk as callable to run on each chunk
+             */
+            template<class Function>
+            void loadInto(Array<T>& arr, Function onChunk);
+
+            // File descriptor is owned, so instances can not be copied
+            ArrayLoader(const ArrayLoader<T>&) = delete;
+            void operator=(const ArrayLoader<T>&) = delete;
+
+        private:
+            int file;
+            long long fileSize;
+            int chunkSize;
+
+            /**
+             * Read given number of bytes at given offset into destination, retrying short reads.
+             * @return true if every byte was read, false otherwise
+             */
+            bool readFully(char* destination, long long bytes, long long offset);
+    };
+
+
+
+
+    template<class T>
+    ArrayLoader<T>::ArrayLoader(const char* path): ArrayLoader(path, 65536)
+    {
+    }
+
+    template<class T>
+    ArrayLoader<T>::ArrayLoader(const char* path, int chunkSize): chunkSize(chunkSize)
+    {
+        // If given chunkSize is negative throw exception
+        if (chunkSize <= 0)
+            throw std::runtime_error("ArrayLoader(const char* path, int chunkSize): Given chunkSize needs to be larger than 0");
+        // Open file for reading
+        file = open(path, O_RDONLY);
+        if (file < 0)
+            throw std::runtime_error("ArrayLoader(const char* path, int chunkSize): Could not open file!");
+        // Find file size
+        struct stat status;
+        if (fstat(file, &status) != 0)
+        {
+            close(file);
+            throw std::runtime_error("ArrayLoader(const char* path, int chunkSize): Could not read file size!");
+        }
+        fileSize = status.st_size;
+        // File needs to hold whole elements
+        if (fileSize % sizeof(T) != 0)
+        {
+            close(file);
+            throw std::runtime_error("ArrayLoader(const char* path, int chunkSize): File size is not a multiple of element size!");
+        }
+    }
+
+    template<class T>
+    ArrayLoader<T>::~ArrayLoader()
+    {
+        // Close file
+        close(file);
+    }
+
+    template<class T>
+    long long ArrayLoader<T>::length()
+    {
+        // Return number of whole elements in file
+        return fileSize / (long long) sizeof(T);
+    }
+
+    template<class T>
+    bool ArrayLoader<T>::readFully(char* destination, long long bytes, long long offset)
+    {
+        while (bytes > 0)
+        {
+            ssize_t bytesRead = pread(file, destination, bytes, offset);
+            // Retry reads interrupted by a signal
+            if (bytesRead < 0 && errno == EINTR)
+                continue;
+            // Error or file got shorter
+            if (bytesRead <= 0)
+                return false;
+            destination += bytesRead;
+            bytes -= bytesRead;
+            offset += bytesRead;
+        }
+        return true;
+    }
+
+    template<class T>
+    void ArrayLoader<T>::loadInto(Array<T>& arr)
+    {
+        // Nothing to do for each chunk
+        loadInto(arr, [](T*, int, int) {});
+    }
+
+    template<class T>
+    template<class Function>
+    void ArrayLoader<T>::loadInto(Array<T>& arr, Function onChunk)
+    {
+        long long count = length();
+        // If arr does not have room for every element, throw runtime_error
+        if (count > arr.maxSize - arr.size)
+            throw std::runtime_error("loadInto: Array does not have room for every element of file!");
+        int start = arr.size;
+        int chunkCount = (int) ((count + chunkSize - 1) / chunkSize);
+        // Shared between reader thread and this thread
+        std::mutex lock;
+        std::condition_variable chunkReady;
+        int chunksRead = 0;
+        bool failed = false;
+        bool stopped = false;
+        // Reader thread reads each chunk into its final place in arr
+        std::thread reader([&]()
+        {
+            for (int c = 0; c < chunkCount; c++)
+            {
+                long long first = (long long) c * chunkSize;
+                long long elements = count - first < chunkSize ? count - first : chunkSize;
+                bool success = readFully((char*) (arr.array + start + first), elements * sizeof(T), first * sizeof(T));
+                std::lock_guard<std::mutex> guard(lock);
+                if (!success)
+                    failed = true;
+                else
+                    chunksRead++;
+                chunkReady.notify_one();
+                // Stop on failure or when this thread gave up
+                if (failed || stopped)
+                    return;
+            }
+        });
+        try
+        {
+            for (int c = 0; c < chunkCount; c++)
+            {
+                // Wait for reader thread to finish chunk c
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    chunkReady.wait(guard, [&]() { return chunksRead > c || failed; });
+                    if (chunksRead <= c)
+                        break;
+                }
+                int first = c * chunkSize;
+                int elements = count - first < chunkSize ? (int) (count - first) : chunkSize;
+                // Chunk is now part of arr
+                arr.size += elements;
+                // Process chunk c while reader thread reads chunk c + 1
+                onChunk(arr.array + start + first, elements, start + first);
+            }
+        }
+        catch (...)
+        {
+            // Stop reader thread before leaving so it does not outlive arr
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopped = true;
+            }
+            reader.join();
+            throw;
+        }
+        reader.join();
+        // If any chunk could not be read, throw runtime_error
+        if (failed)
+            throw std::runtime_error("loadInto: Could not read file!");
+    }
+
+
+}
+
+
+
+
+#endif //ARRAY_ARRAYLOADER_H
@@ -0,0 +1,637 @@
+//
+// Created by Justin Su on 10/19/2026.
+//
+/**
+    Constructors
+        PackedArray()
+        PackedArray(int maxSize)
+        PackedArray(const PackedArray<T>& existingArray)
+        PackedArray(const std::initializer_list<T>& list)
+    Destructors
+        ~PackedArray()
+    Member functions
+        void insertAtEnd(T newValue)
+        int indexOf(T value)
+        T front()
+        T back()
+        T at(int position)
+        bool isFull()
+        bool isEmpty()
+        int length()
+        int capacity()
+        int blockCount()
+        long long byteSize()
+        void decodeBlock(int blockIndex, T* output)
+        void clear()
+        void print()
+        void operator=(const PackedArray<T>& arr)
+        T operator[](int position)
+    Private member variables
+        Block* blocks;
+        T* tail;
+        int size;
+        int maxSize;
+ */
+#ifndef ARRAY_PACKEDARRAY_H
+#define ARRAY_PACKEDARRAY_H
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+namespace justin_su
+{
+    template<class T>
+    /**
+     * Justin Su's implementation of a fixed Array of integers stored in compressed form.
+     * Elements are grouped into blocks of BLOCK_SIZE values. Every full block is stored
+     * as its minimum value (frame of reference) followed by the bit-packed offsets of
+     * each element from that minimum. The last block that is not full yet is kept
+     * uncompressed until it fills up.
+     * @tparam T as integral datatype PackedArray will have
+     */
+    class PackedArray
+    {
+        static_assert(std::is_integral<T>::value, "PackedArray: T needs to be an integral type");
+
+        public:
+
+            /**
+             * Number of elements stored in each compressed block.
+             */
+            static const int BLOCK_SIZE = 128;
+
+            /**
+             * Default constructor.
+             * Sets length to be 0.
+             * Sets maxSize to be 10.
+             * Allocates block directory and uncompressed tail block.
+             */
+            PackedArray();
+
+            /**
+             * Creates a packed array with a maximum size of given maxSize.
+             * Sets length to be 0.
+             * Sets maxSize to be given maxSize.
+             * If maxSize is not greater than 0, throw runtime_error
+             * @param maxSize max number of elements packed array can hold as int
+             */
+            PackedArray(int maxSize);
+
+            /**
+             * Copy constructor.
+             * Copies size, maxSize, every compressed block and the tail block of existingArray.
+             * @param existingArray as existing instance of this class.
+             */
+            PackedArray(const PackedArray<T>& existingArray);
+
+            /**
+             * Constructor with initializer list.
+             * Sets maxSize to be the size of the initializer list.
+             * Appends every element of list with insertAtEnd.
+             * @param list as initializer_list of elements with data type T to be copied
+             */
+            PackedArray(const std::initializer_list<T>& list);
+
+            /**
+             * Destructor.
+             * Deallocates every compressed block, the block directory and the tail block.
+             */
+            ~PackedArray();
+
+            /**
+             * Insert given newValue at end of packed array.
+             * If packed array is full, throw runtime_error.
+             * When the tail block reaches BLOCK_SIZE elements it is compressed.
+             * Postcondition: Given newValue is added to end of packed array
+             *                Size is increased by 1
+             * @param newValue as new element to be added to end of packed array with data type T
+             */
+            void insertAtEnd(T newValue);
+
+            /**
+             * Return the zero-based index of the first occurrence of the given value.
+             * Compressed blocks whose min/max range does not contain value are skipped
+             * without being decoded.
+             * If value does not exist, return -1
+             * @param value as target value to search for
+             * @return the index where the given value is at or -1
+             */
+            int indexOf(T value);
+
+            /**
+             * Return the first element of the packed array.
+             * If packed array is empty, throw runtime_error
+             * @return the first element of the packed array
+             */
+            T front();
+
+            /**
+             * Return the last element of the packed array.
+             * If packed array is empty, throw runtime_error
+             * @return the last element of the packed array
+             */
+            T back();
+
+            /**
+             * Return the element at the given position.
+             * Only the bits of that one element are read, so access is constant time.
+             * If position is out of bounds, throw runtime_error
+             * @param position as zero-based index of element to be returned
+             * @return the element of the packed array at the given position
+             */
+            T at(int position);
+
+            /**
+             * Return whether or not the packed array is full.
+             * @return true if size == maxSize, false otherwise
+             */
+            bool isFull();
+
+            /**
+             * Return whether or not the packed array is empty.
+             * @return true if size == 0, false otherwise
+             */
+            bool isEmpty();
+
+            /**
+             * Return the size of the packed array.
+             * @return size of packed array as int
+             */
+            int length();
+
+            /**
+             * Return the maxSize of the packed array.
+             * @return maxSize of packed array as int
+             */
+            int capacity();
+
+            /**
+             * Return the number of blocks in use, including the uncompressed tail block.
+             * @return number of blocks as int
+             */
+            int blockCount();
+
+            /**
+             * Return the number of bytes used to store the elements.
+             * Counts the packed words and header of every compressed block plus the tail block.
+             * Dividing length() * sizeof(T) by this gives the compression ratio.
+             * @return number of bytes as long long
+             */
+            long long byteSize();
+
+            /**
+             * Decode every element of the block at given blockIndex into output.
+             * output needs room for BLOCK_SIZE elements.
+             * If blockIndex is out of bounds, throw runtime_error
+             * @param blockIndex as zero-based index of the block
+             * @param output as destination of the decoded elements
+             */
+            void decodeBlock(int blockIndex, T* output);
+
+            /**
+             * Clear the packed array.
+             * Deallocates every compressed block.
+             * Sets size to 0
+             */
+            void clear();
+
+            /**
+             * Outputs the elements of the packed array in between brackets
+             */
+            void print();
+
+            /**
+             * Copies the size, maxSize, and blocks from existing PackedArray instance to this instance
+             * @param arr existing instance of this class
+             */
+            void operator=(const PackedArray<T>& arr);
+
+            /**
+             * Returns the element at given index using bracket operator.
+             * Returns by value since elements are not stored individually.
+             * If index is < 0 or index is greater than size - 1, throw runtime_error exception
+             * @param index as index of element to be returned
+             * @return the element at given index
+             */
+            T operator[](int index);
+
+        private:
+            /**
+             * Header of one compressed block.
+             * words holds BLOCK_SIZE offsets of bitWidth bits each, which is 2 * bitWidth words.
+             */
+            struct Block
+            {
+                T min;
+                T max;
+                int bitWidth;
+                uint64_t* words;
+            };
+
+            Block* blocks;
+            T* tail;
+            int size;
+            int maxSize;
+
+            /**
+             * Number of blocks the directory has room for.
+             */
+            int directorySize();
+
+            /**
+             * Compress the full tail block into the next entry of the block directory.
+             */
+            void packTail();
+
+            /**
+             * Read the offset at given index of a compressed block.
+             */
+            static uint64_t unpack(const Block& block, int index);
+
+            /**
+             * Allocate the block directory and tail block for maxSize.
+             */
+            void allocate();
+
+            /**
+             * Deallocate every compressed block, the block directory and the tail block.
+             */
+            void deallocate();
+
+            /**
+             * Copy size, maxSize and every block from arr. Storage needs to be deallocated.
+             */
+            void copyFrom(const PackedArray<T>& arr);
+    };
+
+
+
+
+    template<class T>
+    PackedArray<T>::PackedArray(): size(0), maxSize(10)
+    {
+        // Allocate block directory and tail block
+        allocate();
+    }
+
+    template<class T>
+    PackedArray<T>::PackedArray(int maxSize): size(0), maxSize(maxSize)
+    {
+        // If given maxSize is negative throw exception
+        if (maxSize <= 0)
+            throw std::runtime_error("PackedArray(int maxSize): Given maxSize needs to be larger than 0");
+        // Allocate block directory and tail block
+        allocate();
+    }
+
+    template<class T>
+    PackedArray<T>::PackedArray(const PackedArray<T>& existingArray)
+    {
+        // Copy blocks of existing instance of this class
+        copyFrom(existingArray);
+    }
+
+    template<class T>
+    PackedArray<T>::PackedArray(const std::initializer_list<T>& list): size(0), maxSize(list.size())
+    {
+        // If list is empty there is nothing to hold
+        if (maxSize <= 0)
+            throw std::runtime_error("PackedArray(const std::initializer_list<T> &list): Given list needs to have elements");
+        // Allocate block directory and tail block
+        allocate();
+        // Append elements so full blocks are compressed as they fill up
+        for (auto element: list)
+            insertAtEnd(element);
+    }
+
+    template<class T>
+    PackedArray<T>::~PackedArray()
+    {
+        // Deallocate blocks
+        deallocate();
+    }
+
+    template<class T>
+    int PackedArray<T>::directorySize()
+    {
+        // Round up so a partial last block has an entry
+        return (maxSize + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+
+    template<class T>
+    void PackedArray<T>::allocate()
+    {
+        // Block words are allocated lazily when a block is compressed
+        blocks = new Block[directorySize()]{};
+        // Tail block holds elements until BLOCK_SIZE of them are inserted
+        tail = new T[BLOCK_SIZE]{};
+    }
+
+    template<class T>
+    void PackedArray<T>::deallocate()
+    {
+        // Deallocate words of each compressed block
+        for (int i = 0; i < size / BLOCK_SIZE; i++)
+            delete[] blocks[i].words;
+        // Deallocate block directory and tail block
+        delete[] blocks;
+        delete[] tail;
+    }
+
+    template<class T>
+    void PackedArray<T>::copyFrom(const PackedArray<T>& arr)
+    {
+        size = arr.size;
+        maxSize = arr.maxSize;
+        allocate();
+        // Copy compressed blocks
+        for (int i = 0; i < size / BLOCK_SIZE; i++)
+        {
+            blocks[i] = arr.blocks[i];
+            int wordCount = 2 * blocks[i].bitWidth;
+            blocks[i].words = new uint64_t[wordCount > 0 ? wordCount : 1]{};
+            for (int j = 0; j < wordCount; j++)
+                blocks[i].words[j] = arr.blocks[i].words[j];
+        }
+        // Copy tail block
+        for (int i = 0; i < BLOCK_SIZE; i++)
+            tail[i] = arr.tail[i];
+    }
+
+    template<class T>
+    void PackedArray<T>::packTail()
+    {
+        Block& block = blocks[size / BLOCK_SIZE];
+        // Find frame of reference of the block
+        block.min = tail[0];
+        block.max = tail[0];
+        for (int i = 1; i < BLOCK_SIZE; i++)
+        {
+            if (tail[i] < block.min)
+                block.min = tail[i];
+            if (tail[i] > block.max)
+                block.max = tail[i];
+        }
+        // Number of bits needed for the largest offset from min
+        uint64_t range = (uint64_t) block.max - (uint64_t) block.min;
+        block.bitWidth = 0;
+        while (block.bitWidth < 64 && (range >> block.bitWidth) != 0)
+            block.bitWidth++;
+        // BLOCK_SIZE offsets of bitWidth bits fit exactly into 2 * bitWidth words
+        int wordCount = 2 * block.bitWidth;
+        block.words = new uint64_t[wordCount > 0 ? wordCount : 1]{};
+        // Pack offsets, splitting an offset across two words when it crosses a word boundary
+        for (int i = 0; i < BLOCK_SIZE && block.bitWidth > 0; i++)
+        {
+            uint64_t offset = (uint64_t) tail[i] - (uint64_t) block.min;
+            int bit = i * block.bitWidth;
+            int word = bit >> 6;
+            int shift = bit & 63;
+            block.words[word] |= offset << shift;
+            if (shift + block.bitWidth > 64)
+                block.words[word + 1] |= offset >> (64 - shift);
+        }
+        // Reset tail block to default values
+        for (int i = 0; i < BLOCK_SIZE; i++)
+            tail[i] = T{};
+    }
+
+    template<class T>
+    uint64_t PackedArray<T>::unpack(const Block& block, int index)
+    {
+        // Every element of the block equals min
+        if (block.bitWidth == 0)
+            return 0;
+        int bit = index * block.bitWidth;
+        int word = bit >> 6;
+        int shift = bit & 63;
+        uint64_t offset = block.words[word] >> shift;
+        // Take the high bits from the next word when the offset crosses a word boundary
+        if (shift + block.bitWidth > 64)
+            offset |= block.words[word + 1] << (64 - shift);
+        // Mask off bits of the next offset
+        if (block.bitWidth < 64)
+            offset &= ((uint64_t) 1 << block.bitWidth) - 1;
+        return offset;
+    }
+
+    template<class T>
+    void PackedArray<T>::decodeBlock(int blockIndex, T* output)
+    {
+        // If given blockIndex is out of bounds, throw runtime_error
+        if (blockIndex < 0 || blockIndex > blockCount() - 1)
+            throw std::runtime_error("decodeBlock: Given blockIndex is out of bounds!");
+        // Tail block is not compressed
+        if (blockIndex == size / BLOCK_SIZE)
+        {
+            for (int i = 0; i < BLOCK_SIZE; i++)
+                output[i] = tail[i];
+            return;
+        }
+        const Block& block = blocks[blockIndex];
+        uint64_t base = (uint64_t) block.min;
+        // Every element of the block equals min
+        if (block.bitWidth == 0)
+        {
+            for (int i = 0; i < BLOCK_SIZE; i++)
+                output[i] = block.min;
+            return;
+        }
+        // Add each offset back onto frame of reference
+        for (int i = 0; i < BLOCK_SIZE; i++)
+            output[i] = (T) (base + unpack(block, i));
+    }
+
+    template<class T>
+    void PackedArray<T>::insertAtEnd(T newValue)
+    {
+        // If packed array is full, throw runtime_error
+        if (isFull())
+            throw std::runtime_error("insertAtEnd: PackedArray is full!");
+        // Add newValue to tail block
+        tail[size % BLOCK_SIZE] = newValue;
+        // Compress tail block once it is full
+        if (size % BLOCK_SIZE == BLOCK_SIZE - 1)
+            packTail();
+        // Increase size by 1
+        size++;
+    }
+
+    template<class T>
+    int PackedArray<T>::indexOf(T value)
+    {
+        int fullBlocks = size / BLOCK_SIZE;
+        // Search compressed blocks
+        for (int b = 0; b < fullBlocks; b++)
+        {
+            const Block& block = blocks[b];
+            // Skip block if value is outside of its range
+            if (value < block.min || value > block.max)
+                continue;
+            // Compare offsets directly so the block does not need to be decoded
+            uint64_t target = (uint64_t) value - (uint64_t) block.min;
+            for (int i = 0; i < BLOCK_SIZE; i++)
+            {
+                if (unpack(block, i) == target)
+                    return b * BLOCK_SIZE + i;
+            }
+        }
+        // Search tail block
+        for (int i = 0; i < size % BLOCK_SIZE; i++)
+        {
+            if (tail[i] == value)
+                return fullBlocks * BLOCK_SIZE + i;
+        }
+        // Otherwise return -1
+        return -1;
+    }
+
+    template<class T>
+    T PackedArray<T>::front()
+    {
+        // If packed array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("front: PackedArray is empty!");
+        // Return the first element
+        return at(0);
+    }
+
+    template<class T>
+    T PackedArray<T>::back()
+    {
+        // If packed array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("back: PackedArray is empty!");
+        // Return the last element
+        return at(size - 1);
+    }
+
+    template<class T>
+    T PackedArray<T>::at(int position)
+    {
+        if (isEmpty())
+            throw std::runtime_error("at: PackedArray is empty!");
+        if (position < 0 || position > size - 1)
+            throw std::runtime_error("at: Given position is out of bounds!");
+        int blockIndex = position / BLOCK_SIZE;
+        // Element is still in the uncompressed tail block
+        if (blockIndex == size / BLOCK_SIZE)
+            return tail[position % BLOCK_SIZE];
+        // Add offset back onto frame of reference
+        const Block& block = blocks[blockIndex];
+        return (T) ((uint64_t) block.min + unpack(block, position % BLOCK_SIZE));
+    }
+
+    template<class T>
+    bool PackedArray<T>::isFull()
+    {
+        // Return if size == maxSize
+        return size == maxSize;
+    }
+
+    template<class T>
+    bool PackedArray<T>::isEmpty()
+    {
+        // Return if size is 0
+        return size == 0;
+    }
+
+    template<class T>
+    int PackedArray<T>::length()
+    {
+        // Return the size member variable
+        return size;
+    }
+
+    template<class T>
+    int PackedArray<T>::capacity()
+    {
+        // Return the maxSize member variable
+        return maxSize;
+    }
+
+    template<class T>
+    int PackedArray<T>::blockCount()
+    {
+        // Count partial tail block as a block
+        return (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+
+    template<class T>
+    long long PackedArray<T>::byteSize()
+    {
+        long long bytes = 0;
+        // Header and packed words of each compressed block
+        for (int i = 0; i < size / BLOCK_SIZE; i++)
+            bytes += sizeof(Block) + 2 * blocks[i].bitWidth * sizeof(uint64_t);
+        // Uncompressed tail block
+        if (size % BLOCK_SIZE != 0)
+            bytes += BLOCK_SIZE * sizeof(T);
+        return bytes;
+    }
+
+    template<class T>
+    void PackedArray<T>::clear()
+    {
+        // Deallocate blocks
+        deallocate();
+        // Set size to 0
+        size = 0;
+        // Reallocate empty block directory and tail block
+        allocate();
+    }
+
+    template<class T>
+    void PackedArray<T>::print()
+    {
+        // Print first bracket
+        std::cout << "[";
+        // Print the elements
+        for (int i = 0; i < size; i++)
+        {
+            // Last element will have no space before it
+            if (i == size - 1)
+                std::cout << at(i);
+            // Print space between elements otherwise
+            else
+                std::cout << at(i) << " ";
+        }
+        // Print last bracket
+        std::cout << "]";
+        // Add newline to next output will be on next line
+        std::cout << std::endl;
+    }
+
+    template<class T>
+    void PackedArray<T>::operator=(const PackedArray<T>& arr)
+    {
+        // Nothing to do when assigning to itself
+        if (this == &arr)
+            return;
+        // Deallocate blocks
+        deallocate();
+        // Copy blocks of arr
+        copyFrom(arr);
+    }
+
+    template<class T>
+    T PackedArray<T>::operator[](int index)
+    {
+        // If array is empty
+        if (isEmpty())
+            throw std::runtime_error("[]: PackedArray is empty!");
+        // If given index is out of bounds, throw runtime_error
+        if (index < 0 || index > size - 1)
+            throw std::runtime_error("[]: Index is out of bounds!");
+        // Return the element at given index
+        return at(index);
+    }
+
+
+}
+
+
+
+
+#endif //ARRAY_PACKEDARRAY_H
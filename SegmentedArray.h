@@ -0,0 +1,627 @@
+//
+// Created by Justin Su on 10/19/2026.
+//
+/**
+    Constructors
+        SegmentedArray()
+        SegmentedArray(const SegmentedArray<T>& existingArray)
+        SegmentedArray(const std::initializer_list<T>& list)
+    Destructors
+        ~SegmentedArray()
+    Member functions
+        void insertAtEnd(T newValue)
+        void removeAtEnd()
+        long long indexOf(T value)
+        T front()
+        T back()
+        T at(size_t position)
+        bool isEmpty()
+        size_t length()
+        size_t chunkCount()
+        void sort()
+        void fill(T value)
+        void clear()
+        void print()
+        void reverse()
+        void forEachChunk(Function function)
+        void operator=(const SegmentedArray<T>& arr)
+        bool operator==(const SegmentedArray<T>& arr)
+        T& operator[](size_t position)
+    Private member variables
+        T** chunks;
+        size_t size;
+        size_t chunksUsed;
+        size_t directorySize;
+ */
+#ifndef ARRAY_SEGMENTEDARRAY_H
+#define ARRAY_SEGMENTEDARRAY_H
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+namespace justin_su
+{
+    template<class T>
+    /**
+     * Justin Su's implementation of a growable Array stored in fixed size chunks.
+     * A directory of pointers leads to chunks of CHUNK_SIZE elements each. Growing only
+     * allocates a new chunk, and sometimes a larger directory, so elements are never
+     * moved and references to them stay valid until they are removed.
+     * @tparam T as datatype SegmentedArray will have
+     */
+    class SegmentedArray
+    {
+        public:
+
+            /**
+             * Number of bits of an index that select the element within a chunk.
+             */
+            static const size_t CHUNK_SHIFT = 16;
+
+            /**
+             * Number of elements in each chunk.
+             */
+            static const size_t CHUNK_SIZE = (size_t) 1 << CHUNK_SHIFT;
+
+            /**
+             * Default constructor.
+             * Sets length to be 0.
+             * Allocates a directory with room for 8 chunks and no chunks.
+             */
+            SegmentedArray();
+
+            /**
+             * Copy constructor.
+             * Copies size and every element of existingArray into newly allocated chunks.
+             * @param existingArray as existing instance of this class.
+             */
+            SegmentedArray(const SegmentedArray<T>& existingArray);
+
+            /**
+             * Constructor with initializer list.
+             * Appends every element of list with insertAtEnd.
+             * @param list as initializer_list of elements with data type T to be copied
+             */
+            SegmentedArray(const std::initializer_list<T>& list);
+
+            /**
+             * Destructor.
+             * Deallocates every chunk and the directory.
+             */
+            ~SegmentedArray();
+
+            /**
+             * Insert given newValue at end of segmented array.
+             * Allocates a new chunk when the last chunk is full.
+             * Doubles the directory when it is full, which copies chunk pointers but no elements.
+             * Postcondition: Given newValue is added to end of segmented array
+             *                Size is increased by 1
+             * @param newValue as new element to be added to end of segmented array with data type T
+             */
+            void insertAtEnd(T newValue);
+
+            /**
+             * Remove the last element in the segmented array.
+             * Deallocates the last chunk when it becomes empty.
+             * If segmented array is already empty, throw runtime_error
+             * Postcondition: The last element has been removed
+             *                Size is decreased by 1
+             */
+            void removeAtEnd();
+
+            /**
+             * Return the zero-based index of the first occurrence of the given value.
+             * If value does not exist, return -1
+             * @param value as target value to search for
+             * @return the index where the given value is at or -1
+             */
+            long long indexOf(T value);
+
+            /**
+             * Return the first element of the segmented array.
+             * If segmented array is empty, throw runtime_error
+             * @return the first element of the segmented array
+             */
+            T front();
+
+            /**
+             * Return the last element of the segmented array.
+             * If segmented array is empty, throw runtime_error
+             * @return the last element of the segmented array
+             */
+            T back();
+
+            /**
+             * Return the element at the given position.
+             * If position is out of bounds, throw runtime_error
+             * @param position as zero-based index of element to be returned
+             * @return the element of the segmented array at the given position
+             */
+            T at(size_t position);
+
+            /**
+             * Return whether or not the segmented array is empty.
+             * @return true if size == 0, false otherwise
+             */
+            bool isEmpty();
+
+            /**
+             * Return the size of the segmented array.
+             * @return size of segmented array as size_t
+             */
+            size_t length();
+
+            /**
+             * Return the number of allocated chunks.
+             * @return number of chunks as size_t
+             */
+            size_t chunkCount();
+
+            /**
+             * Sort the segmented array in ascending order.
+             * Uses heap sort, which needs no extra memory and no contiguous storage.
+             * Postcondition: Segmented array is sorted in ascending order
+             */
+            void sort();
+
+            /**
+             * Set every element of the segmented array to given value.
+             * Chunks are filled in parallel by forEachChunk.
+             * Postcondition: Every element is equal to value, size is unchanged
+             * @param value as value every element is set to
+             */
+            void fill(T value);
+
+            /**
+             * Clear the segmented array.
+             * Deallocates every chunk.
+             * Sets size to 0
+             */
+            void clear();
+
+            /**
+             * Outputs the elements of the segmented array in between brackets
+             */
+            void print();
+
+            /**
+             * Reverses the elements of the segmented array.
+             * Postcondition: The order of the elements in the segmented array are reversed.
+             */
+            void reverse();
+
+            /**
+             * Call given function once for every chunk, spreading chunks across hardware threads.
+             * function is called as function(T* elements, size_t count, size_t firstIndex)
+             * where elements points to the count elements in use starting at index firstIndex.
+             * Calls on different chunks may run at the same time.
+             * @param function as callable to run on each chunk
+             */
+            template<class Function>
+            void forEachChunk(Function function);
+
+            /**
+             * Copies the size and elements from existing SegmentedArray instance to this instance
+             * @param arr existing instance of this class
+             */
+            void operator=(const SegmentedArray<T>& arr);
+
+            /**
+             * Returns whether or not two instances of this class are equal.
+             * Two instances of this class are equal if their size and elements are equal
+             * @param arr as existing instance of this class
+             * @return true if the instances of this class are equal, false if not
+             */
+            bool operator==(const SegmentedArray<T>& arr);
+
+            /**
+             * Returns the element at given index using bracket operator
+             * If index is greater than size - 1, throw runtime_error exception
+             * @param index as index of element to be returned
+             * @return the element at given index
+             */
+            T& operator[](size_t index);
+
+        private:
+            T** chunks;
+            size_t size;
+            size_t chunksUsed;
+            size_t directorySize;
+
+            /**
+             * Return the element at given index without checking bounds.
+             */
+            T& element(size_t index);
+
+            /**
+             * Move element at given index down the heap of given heapSize until it is
+             * not smaller than its children.
+             */
+            void siftDown(size_t index, size_t heapSize);
+
+            /**
+             * Copy size and every element from arr. Storage needs to be deallocated.
+             */
+            void copyFrom(const SegmentedArray<T>& arr);
+
+            /**
+             * Deallocate every chunk and the directory.
+             */
+            void deallocate();
+    };
+
+
+
+
+    template<class T>
+    SegmentedArray<T>::SegmentedArray(): size(0), chunksUsed(0), directorySize(8)
+    {
+        // Chunks are allocated as elements are inserted
+        chunks = new T*[directorySize]{};
+    }
+
+    template<class T>
+    SegmentedArray<T>::SegmentedArray(const SegmentedArray<T>& existingArray)
+    {
+        // Copy elements of existing instance of this class
+        copyFrom(existingArray);
+    }
+
+    template<class T>
+    SegmentedArray<T>::SegmentedArray(const std::initializer_list<T>& list): SegmentedArray()
+    {
+        // Append elements of list
+        for (auto element: list)
+            insertAtEnd(element);
+    }
+
+    template<class T>
+    SegmentedArray<T>::~SegmentedArray()
+    {
+        // Deallocate chunks and directory
+        deallocate();
+    }
+
+    template<class T>
+    void SegmentedArray<T>::deallocate()
+    {
+        // Deallocate each chunk
+        for (size_t i = 0; i < chunksUsed; i++)
+            delete[] chunks[i];
+        // Deallocate directory
+        delete[] chunks;
+    }
+
+    template<class T>
+    void SegmentedArray<T>::copyFrom(const SegmentedArray<T>& arr)
+    {
+        size = arr.size;
+        chunksUsed = arr.chunksUsed;
+        directorySize = arr.directorySize;
+        chunks = new T*[directorySize]{};
+        // Copy each chunk
+        for (size_t i = 0; i < chunksUsed; i++)
+        {
+            chunks[i] = new T[CHUNK_SIZE]{};
+            for (size_t j = 0; j < CHUNK_SIZE; j++)
+                chunks[i][j] = arr.chunks[i][j];
+        }
+    }
+
+    template<class T>
+    T& SegmentedArray<T>::element(size_t index)
+    {
+        // High bits select the chunk, low bits select the element within it
+        return chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)];
+    }
+
+    template<class T>
+    void SegmentedArray<T>::insertAtEnd(T newValue)
+    {
+        // Last chunk is full or there are no chunks yet
+        if (size == chunksUsed * CHUNK_SIZE)
+        {
+            // Double the directory when it is full, only chunk pointers are copied
+            if (chunksUsed == directorySize)
+            {
+                T** newChunks = new T*[directorySize * 2]{};
+                for (size_t i = 0; i < chunksUsed; i++)
+                    newChunks[i] = chunks[i];
+                delete[] chunks;
+                chunks = newChunks;
+                directorySize *= 2;
+            }
+            // Allocate new chunk
+            chunks[chunksUsed] = new T[CHUNK_SIZE]{};
+            chunksUsed++;
+        }
+        // Set last element to newValue
+        element(size) = newValue;
+        // Increase size by 1
+        size++;
+    }
+
+    template<class T>
+    void SegmentedArray<T>::removeAtEnd()
+    {
+        // If segmented array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("removeAtEnd: SegmentedArray is already empty!");
+        // Set the last element to be the default value
+        element(size - 1) = T{};
+        // Decrease size by 1
+        size--;
+        // Deallocate last chunk once it is empty
+        if (size == (chunksUsed - 1) * CHUNK_SIZE)
+        {
+            chunksUsed--;
+            delete[] chunks[chunksUsed];
+            chunks[chunksUsed] = nullptr;
+        }
+    }
+
+    template<class T>
+    long long SegmentedArray<T>::indexOf(T value)
+    {
+        // Traverse each chunk
+        for (size_t c = 0; c < chunksUsed; c++)
+        {
+            T* chunk = chunks[c];
+            size_t count = c == chunksUsed - 1 ? size - c * CHUNK_SIZE : CHUNK_SIZE;
+            for (size_t i = 0; i < count; i++)
+            {
+                // If the given value is found return the index
+                if (chunk[i] == value)
+                    return (long long) (c * CHUNK_SIZE + i);
+            }
+        }
+        // Otherwise return -1
+        return -1;
+    }
+
+    template<class T>
+    T SegmentedArray<T>::front()
+    {
+        // If segmented array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("front: SegmentedArray is empty!");
+        // Return the first element
+        return element(0);
+    }
+
+    template<class T>
+    T SegmentedArray<T>::back()
+    {
+        // If segmented array is empty, throw runtime_error
+        if (isEmpty())
+            throw std::runtime_error("back: SegmentedArray is empty!");
+        // Return the last element
+        return element(size - 1);
+    }
+
+    template<class T>
+    T SegmentedArray<T>::at(size_t position)
+    {
+        if (isEmpty())
+            throw std::runtime_error("at: SegmentedArray is empty!");
+        if (position > size - 1)
+            throw std::runtime_error("at: Given position is out of bounds!");
+        // Return the element at given position
+        return element(position);
+    }
+
+    template<class T>
+    bool SegmentedArray<T>::isEmpty()
+    {
+        // Return if size is 0
+        return size == 0;
+    }
+
+    template<class T>
+    size_t SegmentedArray<T>::length()
+    {
+        // Return the size member variable
+        return size;
+    }
+
+    template<class T>
+    size_t SegmentedArray<T>::chunkCount()
+    {
+        // Return the chunksUsed member variable
+        return chunksUsed;
+    }
+
+    template<class T>
+    void SegmentedArray<T>::siftDown(size_t index, size_t heapSize)
+    {
+        while (true)
+        {
+            size_t largest = index;
+            size_t left = 2 * index + 1;
+            size_t right = left + 1;
+            // Find largest of the element and its children
+            if (left < heapSize && element(left) > element(largest))
+                largest = left;
+            if (right < heapSize && element(right) > element(largest))
+                largest = right;
+            // Stop once the element is not smaller than its children
+            if (largest == index)
+                return;
+            // Swap
+            T temp = element(index);
+            element(index) = element(largest);
+            element(largest) = temp;
+            index = largest;
+        }
+    }
+
+    template<class T>
+    void SegmentedArray<T>::sort()
+    {
+        // If there are 0 or 1 element
+        if (size < 2)
+            return;
+        // Build max heap
+        for (size_t i = size / 2; i > 0; i--)
+            siftDown(i - 1, size);
+        // Move largest remaining element to the end of the unsorted part
+        for (size_t end = size - 1; end > 0; end--)
+        {
+            T temp = element(0);
+            element(0) = element(end);
+            element(end) = temp;
+            siftDown(0, end);
+        }
+    }
+
+    template<class T>
+    void SegmentedArray<T>::fill(T value)
+    {
+        // Set the elements of each chunk to given value
+        forEachChunk([value](T* elements, size_t count, size_t)
+        {
+            for (size_t i = 0; i < count; i++)
+                elements[i] = value;
+        });
+    }
+
+    template<class T>
+    void SegmentedArray<T>::clear()
+    {
+        // Deallocate chunks and directory
+        deallocate();
+        // Set size to 0
+        size = 0;
+        chunksUsed = 0;
+        // Reallocate empty directory
+        chunks = new T*[directorySize]{};
+    }
+
+    template<class T>
+    void SegmentedArray<T>::print()
+    {
+        // Print first bracket
+        std::cout << "[";
+        // Print the elements
+        for (size_t i = 0; i < size; i++)
+        {
+            // Last element will have no space before it
+            if (i == size - 1)
+                std::cout << element(i);
+            // Print space between elements otherwise
+            else
+                std::cout << element(i) << " ";
+        }
+        // Print last bracket
+        std::cout << "]";
+        // Add newline to next output will be on next line
+        std::cout << std::endl;
+    }
+
+    template<class T>
+    void SegmentedArray<T>::reverse()
+    {
+        // If segmented array only has one element or it is empty then return
+        if (size < 2)
+            return;
+        // Set pointers to beginning and end of segmented array
+        size_t start = 0;
+        size_t end = size - 1;
+        // as long as start and end pointers do not meet each other
+        while (start < end)
+        {
+            // Swap
+            T temp = element(start);
+            element(start) = element(end);
+            element(end) = temp;
+            start++;
+            end--;
+        }
+    }
+
+    template<class T>
+    template<class Function>
+    void SegmentedArray<T>::forEachChunk(Function function)
+    {
+        size_t threadCount = std::thread::hardware_concurrency();
+        // Do not start more threads than there are chunks
+        if (threadCount > chunksUsed)
+            threadCount = chunksUsed;
+        // Run on this thread when there is nothing to split
+        if (threadCount < 2)
+        {
+            for (size_t c = 0; c < chunksUsed; c++)
+            {
+                size_t count = c == chunksUsed - 1 ? size - c * CHUNK_SIZE : CHUNK_SIZE;
+                function(chunks[c], count, c * CHUNK_SIZE);
+            }
+            return;
+        }
+        std::thread* threads = new std::thread[threadCount];
+        // Each thread takes every threadCount-th chunk
+        for (size_t t = 0; t < threadCount; t++)
+        {
+            threads[t] = std::thread([this, t, threadCount, &function]()
+            {
+                for (size_t c = t; c < chunksUsed; c += threadCount)
+                {
+                    size_t count = c == chunksUsed - 1 ? size - c * CHUNK_SIZE : CHUNK_SIZE;
+                    function(chunks[c], count, c * CHUNK_SIZE);
+                }
+            });
+        }
+        for (size_t t = 0; t < threadCount; t++)
+            threads[t].join();
+        // Deallocate threads
+        delete[] threads;
+    }
+
+    template<class T>
+    void SegmentedArray<T>::operator=(const SegmentedArray<T>& arr)
+    {
+        // Nothing to do when assigning to itself
+        if (this == &arr)
+            return;
+        // Deallocate chunks and directory
+        deallocate();
+        // Copy elements of arr
+        copyFrom(arr);
+    }
+
+    template<class T>
+    bool SegmentedArray<T>::operator==(const SegmentedArray<T>& arr)
+    {
+        // If size is not equal to arr.size
+        if (size != arr.size)
+            return false;
+        // Check if any elements are different
+        for (size_t i = 0; i < size; i++)
+        {
+            if (element(i) != arr.chunks[i >> CHUNK_SHIFT][i & (CHUNK_SIZE - 1)])
+                return false;
+        }
+        // Otherwise return true
+        return true;
+    }
+
+    template<class T>
+    T& SegmentedArray<T>::operator[](size_t index)
+    {
+        // If segmented array is empty
+        if (isEmpty())
+            throw std::runtime_error("[]: SegmentedArray is empty!");
+        // If given index is out of bounds, throw runtime_error
+        if (index > size - 1)
+            throw std::runtime_error("[]: Index is out of bounds!");
+        // Return the element at given index
+        return element(index);
+    }
+
+
+}
+
+
+
+
+#endif //ARRAY_SEGMENTEDARRAY_H